@@ -12,6 +12,7 @@
 #include<exception>
 #include<sstream>
 #include<iomanip>
+#include<vector>
 #include "polycalculator.hpp"
 using namespace std;
 
@@ -26,7 +27,13 @@ void listCommands()
 		<<"mul                  : Multiply the polynomials (Exp1 * Exp2)"<<endl
 		<<"evaluate <ExpID,int> : Evaluate a polynomial for a specific value of x"<<endl
 		<<"getDegree <ExpID>    : Returns the degree of a given polynomial."<<endl     
+		<<"deriv <ExpID>        : Differentiate a polynomial"<<endl
+		<<"integ <ExpID>        : Integrate a polynomial (integer coefficients only)"<<endl
+		<<"evalder <ExpID,x,k>  : Evaluate p(x) and its first k derivatives (x may be a space-separated list)"<<endl
+		<<"roots <ExpID[,tol]>  : Find all (complex) roots of a polynomial"<<endl
 		<<"read <file_name>     : Load the data from <file> and add it into the Linked Lists"<<endl
+		<<"history              : Display all previous add/sub/mul/deriv/integ/addterm results"<<endl
+		<<"addterm <n,coef,exp> : Store a copy of result #n with coef*x^exp added"<<endl
 		<<"help                 : Display the list of available commands"<<endl
 		<<"exit                 : Exit the Program"<<endl;
 }
@@ -49,6 +56,8 @@ int main()
 			getline(cin,user_input);
 			
 			// parse userinput into command and parameter(s)
+			parameter1.clear();
+			parameter2.clear();
 			stringstream sstr(user_input);
 			getline(sstr,command,' ');
 			getline(sstr,parameter1,',');
@@ -63,7 +72,30 @@ int main()
 			else if(command == "mul")		polycalc.mul();
 			else if(command == "evaluate")	polycalc.evaluate(stoi(parameter1),stoi(parameter2));
 			else if(command == "getDegree")    cout<<"The degree of Exp"<<parameter1<<" is: "<<polycalc.getDegree(stoi(parameter1))<<endl;
+			else if(command == "deriv")		polycalc.deriv(stoi(parameter1));
+			else if(command == "integ")		polycalc.integ(stoi(parameter1));
+			else if(command == "evalder")
+			{
+				// parameter2 holds "<x>[ <x> ...],<k>"
+				size_t comma = parameter2.rfind(',');
+				if(comma == string::npos) throw invalid_argument("usage: evalder <ExpID>,<x>,<k>");
+				vector<int> xs;
+				stringstream xstr(parameter2.substr(0,comma));
+				string token;
+				while(xstr>>token) xs.push_back(stoi(token));
+				if(xs.empty()) throw invalid_argument("evalder needs at least one x value");
+				polycalc.evalder(stoi(parameter1),xs,stoi(parameter2.substr(comma+1)));
+			}
+			else if(command == "roots")		parameter2.empty() ? polycalc.roots(stoi(parameter1)) : polycalc.roots(stoi(parameter1),stod(parameter2));
 			else if(command =="read")		polycalc.read(parameter1),polycalc.display();
+			else if(command == "history")	polycalc.showHistory();
+			else if(command == "addterm")
+			{
+				// parameter2 holds "<coef>,<exp>"
+				size_t comma = parameter2.find(',');
+				if(comma == string::npos) throw invalid_argument("usage: addterm <n>,<coef>,<exp>");
+				polycalc.addTerm(stoi(parameter1),stoi(parameter2.substr(0,comma)),stoi(parameter2.substr(comma+1)));
+			}
 			else if(command == "help")		listCommands();
 			else if(command == "exit" or command=="quit")			break;
 			else 		cout<<"Invalid Command!!"<<endl;
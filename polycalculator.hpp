@@ -14,6 +14,15 @@
 #include<cmath>
 #include<sstream>
 #include<cctype>
+#include<vector>
+#include<complex>
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<atomic>
+#include<numeric>
+#include<chrono>
+#include<algorithm>
 
 // Use standard namespace for brevity in this assignment
 using namespace std;
@@ -43,8 +52,9 @@ class Node
 		Node(int coef, int expo) : coef(coef), expo(expo), next(nullptr)
 		{}
 		
-		// Grant access to LinkedList and PolyCalculator internals
+		// Grant access to LinkedList, SharedPoly and PolyCalculator internals
 		friend class LinkedList;
+		friend class SharedPoly;
 		friend class PolyCalculator;
 		
 	public:
@@ -88,11 +98,108 @@ class LinkedList
 	public:
 		// PolyCalculator needs access to head for operations
 		friend class PolyCalculator;
+		// SharedPoly snapshots/rebuilds lists directly from head
+		friend class SharedPoly;
 		
 		/* Required for Autograder — Do not remove */
 		friend void run_tests();
 	};
 
+//========================== SharedPoly =======================================
+
+// An immutable, reference-counted term used by SharedPoly.
+// Once a node is linked into a SharedPoly it is never modified, so any
+// number of polynomials may point at the same node (shared suffix).
+// Invariants:
+//   - 'refs' counts incoming pointers (SharedPoly heads + 'next' links).
+//   - Nodes are chained in STRICTLY ASCENDING order of 'expo', so the
+//     shared suffix of a list holds its higher-degree terms.
+class SharedNode
+{
+	private:
+		// Coefficient of the term (never 0)
+		int coef;
+		// Exponent of the term
+		int expo;
+		// Next (higher-degree) node, or nullptr
+		SharedNode* next;
+		// Number of owners pointing at this node
+		int refs;
+
+	public:
+		// Construct a node with (coef, expo) and a single owner
+		SharedNode(int coef, int expo) : coef(coef), expo(expo), next(nullptr), refs(1)
+		{}
+
+		// Grant access to SharedPoly internals
+		friend class SharedPoly;
+
+	public:
+		/* Required for Autograder — Do not remove */
+		friend void run_tests();
+};
+
+// A persistent polynomial: copies are O(1) (they share every node) and
+// insert() is copy-on-write, duplicating only the terms below the updated
+// exponent and sharing the rest. add()/sub() reuse whichever input tail
+// remains once the other input runs out, e.g. p + c*x^0 copies one node.
+//
+// Same polynomial invariants as LinkedList (one node per exponent, no zero
+// coefficients), but stored in ascending order; print() restores the
+// canonical descending form.
+class SharedPoly
+{
+	private:
+		// Lowest-degree term (nullptr means empty polynomial)
+		SharedNode* head;
+
+		// Take ownership of an already-retained chain
+		explicit SharedPoly(SharedNode* head);
+
+		// Add one owner to 'node' (no-op on nullptr) and return it
+		static SharedNode* retain(SharedNode* node);
+
+		// Drop one owner from 'node', freeing every node that becomes unowned
+		static void release(SharedNode* node);
+
+	public:
+		// Create an empty polynomial
+		SharedPoly();
+
+		// Snapshot a LinkedList (one linear pass)
+		explicit SharedPoly(const LinkedList &list);
+
+		// O(1) copy: shares the whole chain
+		SharedPoly(const SharedPoly &other);
+		SharedPoly& operator=(const SharedPoly &other);
+
+		// Release this handle's reference
+		~SharedPoly();
+
+		// Copy-on-write insert of (coef, expo), combining like terms
+		void insert(int coef, int expo);
+
+		// a + b and a - b; results share the unconsumed tail of an input
+		static SharedPoly add(const SharedPoly &a, const SharedPoly &b);
+		static SharedPoly sub(const SharedPoly &a, const SharedPoly &b);
+
+		// Print the polynomial to a stream in canonical (descending) form
+		void print(ostream& os=std::cout) const;
+
+		// Highest exponent, or -1 for the empty polynomial
+		int getDegree() const;
+
+		// Rebuild 'list' from this polynomial
+		void toList(LinkedList &list) const;
+
+		// Same terms in same order (shared suffixes compare in O(1))
+		bool operator==(const SharedPoly &other) const;
+
+	public:
+		/* Required for Autograder — Do not remove */
+		friend void run_tests();
+};
+
 //========================== PolyCalculator ===================================
 
 // Wrapper that owns Exp1 (list1), Exp2 (list2), and result (list3)
@@ -103,6 +210,10 @@ class PolyCalculator
 		LinkedList list1;
 		LinkedList list2;
 		LinkedList list3;
+
+		// Persistent copies of every add/sub/mul/deriv/integ/addterm result.
+		// Entries share structure with each other wherever possible.
+		std::vector<SharedPoly> history;
 		
 	public:
 		// Read two expressions from keyboard into list1 and list2
@@ -117,7 +228,7 @@ class PolyCalculator
 		// Compute list3 = list1 + list2 and print
 		void add();  
 		
-		// Compute list3 = list2 - list1 and print  (matches main.cpp help)
+		// Compute list3 = list1 - list2 and print
 		void sub();  
 		
 		// Compute list3 = list1 * list2 and print
@@ -125,15 +236,34 @@ class PolyCalculator
 		
 		// Print p(x) then p(value) for the chosen expression (1 or 2)
 		void evaluate(int expID, int x); 
+
+		// Compute list3 = d/dx of the chosen expression and print
+		void deriv(int expID);
+
+		// Compute list3 = integral of the chosen expression (constant 0) and
+		// print; fails if any coefficient would not be an integer
+		void integ(int expID);
+
+		// Print p(x), p'(x), ..., p^(k)(x) for every x in 'xs'
+		void evalder(int expID, const std::vector<int> &xs, int k);
 		
 		// Return the degree (max exponent) of the chosen expression
 		int getDegree(int expID);	
+
+		// Print every complex root of the chosen expression (Aberth–Ehrlich)
+		void roots(int expID, double tol=1e-12);
 		
 		// Convenience: report whether Exp1 == Exp2
 		void isEqual(); 
 		
 		// Load Exp1 and Exp2 from a file (first two lines)
 		void read(std::string path); 
+
+		// Print every stored result, oldest first
+		void showHistory(std::ostream &os=std::cout);
+
+		// Append a copy of history entry 'n' (1-based) with coef*x^expo added
+		void addTerm(int n, int coef, int expo);
 		
 		// You can add more methods or helper functions if needed.
 		
@@ -264,6 +394,224 @@ LinkedList::~LinkedList() {
     removeAll();
 } 
 
+//============================== SharedPoly ===================================
+
+// Adopt a chain whose head reference was already counted by the caller
+SharedPoly::SharedPoly(SharedNode* head): head(head) {}
+
+// Initialize an empty polynomial
+SharedPoly::SharedPoly(): head(nullptr) {}
+
+// Bump the owner count of 'node' (if any) and hand it back
+SharedNode* SharedPoly::retain(SharedNode* node) {
+    if (node != nullptr) node->refs++;
+    return node;
+}
+
+// Drops one reference; a node that loses its last owner is freed and
+// its reference to 'next' is dropped in turn (iterative, like removeAll()).
+void SharedPoly::release(SharedNode* node) {
+    while (node != nullptr && --node->refs == 0) {
+        SharedNode* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+// Walking the descending list and pushing each term on the front yields
+// the ascending chain in a single pass.
+SharedPoly::SharedPoly(const LinkedList &list): head(nullptr) {
+    for (Node* c = list.head; c != nullptr; c = c->next) {
+        SharedNode* n = new SharedNode(c->coef, c->expo);
+        n->next = head;
+        head = n;
+    }
+}
+
+// Copies only add an owner to the first node; the chain itself is shared
+SharedPoly::SharedPoly(const SharedPoly &other): head(retain(other.head)) {}
+
+SharedPoly& SharedPoly::operator=(const SharedPoly &other) {
+    // Retain before release so self-assignment is safe
+    SharedNode* old = head;
+    head = retain(other.head);
+    release(old);
+    return *this;
+}
+
+SharedPoly::~SharedPoly() {
+    release(head);
+}
+
+// Copy-on-write insert. Terms below 'expo' are duplicated (they precede the
+// change), the term at 'expo' is rebuilt or dropped, and everything above
+// it is shared with the old version. Other handles never observe the edit.
+void SharedPoly::insert(int coef, int expo) {
+    // Skip inserting pure zero terms
+    if (coef == 0) return;
+
+    SharedNode* newHead = nullptr;
+    SharedNode* tail = nullptr;
+    auto append = [&](SharedNode* n) {
+        if (tail == nullptr) newHead = n;
+        else tail->next = n;
+        tail = n;
+    };
+
+    // Copy the prefix of lower-degree terms
+    SharedNode* curr = head;
+    while (curr != nullptr && curr->expo < expo) {
+        append(new SharedNode(curr->coef, curr->expo));
+        curr = curr->next;
+    }
+
+    // Merge with an existing term (dropping it if the sum is zero) or add a new one
+    if (curr != nullptr && curr->expo == expo) {
+        int sum = curr->coef + coef;
+        if (sum != 0) append(new SharedNode(sum, expo));
+        curr = curr->next;
+    } else {
+        append(new SharedNode(coef, expo));
+    }
+
+    // Share the untouched higher-degree suffix
+    SharedNode* suffix = retain(curr);
+    if (tail == nullptr) newHead = suffix;
+    else tail->next = suffix;
+
+    release(head);
+    head = newHead;
+}
+
+// a + b via an ascending merge-walk (same shape as PolyCalculator::add()).
+// As soon as either input is exhausted, the other's remaining chain is
+// shared instead of copied.
+SharedPoly SharedPoly::add(const SharedPoly &a, const SharedPoly &b) {
+    SharedNode* newHead = nullptr;
+    SharedNode* tail = nullptr;
+    auto append = [&](int coef, int expo) {
+        SharedNode* n = new SharedNode(coef, expo);
+        if (tail == nullptr) newHead = n;
+        else tail->next = n;
+        tail = n;
+    };
+
+    SharedNode* p1 = a.head;
+    SharedNode* p2 = b.head;
+    while (p1 != nullptr && p2 != nullptr) {
+        if (p1->expo == p2->expo) {
+            int sum = p1->coef + p2->coef;
+            if (sum != 0) append(sum, p1->expo);
+            p1 = p1->next;
+            p2 = p2->next;
+        } else if (p1->expo < p2->expo) {
+            append(p1->coef, p1->expo);
+            p1 = p1->next;
+        } else {
+            append(p2->coef, p2->expo);
+            p2 = p2->next;
+        }
+    }
+
+    // Share whichever tail is left (at most one is non-null). Only a tail
+    // past the last common exponent can be shared; overlapping terms such
+    // as those of p + p always produce new nodes.
+    SharedNode* rest = retain(p1 != nullptr ? p1 : p2);
+    if (tail == nullptr) newHead = rest;
+    else tail->next = rest;
+
+    return SharedPoly(newHead);
+}
+
+// a - b. Only a's leftover tail can be shared; b's leftover terms must be
+// negated, so they are copied.
+SharedPoly SharedPoly::sub(const SharedPoly &a, const SharedPoly &b) {
+    SharedNode* newHead = nullptr;
+    SharedNode* tail = nullptr;
+    auto append = [&](int coef, int expo) {
+        SharedNode* n = new SharedNode(coef, expo);
+        if (tail == nullptr) newHead = n;
+        else tail->next = n;
+        tail = n;
+    };
+
+    SharedNode* p1 = a.head;
+    SharedNode* p2 = b.head;
+    while (p1 != nullptr && p2 != nullptr) {
+        if (p1->expo == p2->expo) {
+            int diff = p1->coef - p2->coef;
+            if (diff != 0) append(diff, p1->expo);
+            p1 = p1->next;
+            p2 = p2->next;
+        } else if (p1->expo < p2->expo) {
+            append(p1->coef, p1->expo);
+            p1 = p1->next;
+        } else {
+            append(-p2->coef, p2->expo);
+            p2 = p2->next;
+        }
+    }
+
+    // Negate what is left of b
+    while (p2 != nullptr) { append(-p2->coef, p2->expo); p2 = p2->next; }
+
+    // Share what is left of a
+    SharedNode* rest = retain(p1);
+    if (tail == nullptr) newHead = rest;
+    else tail->next = rest;
+
+    return SharedPoly(newHead);
+}
+
+// Prints in the same format as LinkedList::print(). The chain is ascending,
+// so terms are buffered and emitted highest exponent first.
+void SharedPoly::print(ostream &os) const {
+    // Empty polynomial is printed as 0
+    if (!head) { os << "0"; return; }
+
+    std::vector<const SharedNode*> terms;
+    for (const SharedNode* c = head; c; c = c->next) terms.push_back(c);
+
+    for (size_t i = terms.size(); i-- > 0; ) {
+        const SharedNode* c = terms[i];
+        if (i + 1 != terms.size()) os << ' ';
+        os << (c->coef >= 0 ? "+" : "") << c->coef << "x^" << c->expo;
+    }
+}
+
+// The highest exponent sits at the end of the ascending chain
+int SharedPoly::getDegree() const {
+    if (!head) return -1;              // empty polynomial
+    const SharedNode* c = head;
+    while (c->next) c = c->next;
+    return c->expo;
+}
+
+// Rebuilds 'list' in one pass: each term has a larger exponent than the
+// current head, so LinkedList::insert() takes its O(1) front-insert path.
+void SharedPoly::toList(LinkedList &list) const {
+    list.removeAll();
+    for (const SharedNode* c = head; c; c = c->next) {
+        list.insert(c->coef, c->expo);
+    }
+}
+
+// Walk both chains in lockstep; reaching the same node means the
+// remaining suffix is shared and therefore equal.
+bool SharedPoly::operator==(const SharedPoly &other) const {
+    const SharedNode* curr1 = head;
+    const SharedNode* curr2 = other.head;
+
+    while (curr1 != curr2) {
+        // One ended before the other ⇒ not equal
+        if (curr1 == nullptr || curr2 == nullptr) return false;
+        if (curr1->coef != curr2->coef || curr1->expo != curr2->expo) return false;
+        curr1 = curr1->next;
+        curr2 = curr2->next;
+    }
+    return true;
+}
+
 //============================== I/O helpers ==================================
 
 // Reads two raw lines from stdin, parses them into normalized polynomials,
@@ -432,42 +780,13 @@ bool PolyCalculator::parse(std::string expr, LinkedList& list) {
 //============================= Operations ====================================
 
 // list3 = list1 + list2
-// Merge-walk both sorted lists by exponent (descending).
-// Equal exponents: sum coefficients (drop if 0).
-// Otherwise: carry the term with the larger exponent.
+// The merge-walk runs once, in SharedPoly::add() on snapshots of Exp1 and
+// Exp2; the result is kept in the history (it takes over the unconsumed
+// input tail instead of copying it) and list3 is rebuilt from it in a
+// single linear pass.
 void PolyCalculator::add() {
-    list3.removeAll();
-
-    Node* p1 = list1.head;
-    Node* p2 = list2.head;
-
-    // Merge like a classic sorted-list merge
-    while (p1 != nullptr && p2 != nullptr) {
-        if (p1->expo == p2->expo) {
-            int sum = p1->coef + p2->coef;
-            if (sum != 0) list3.insert(sum, p1->expo);
-            p1 = p1->next;
-            p2 = p2->next;
-        } else if (p1->expo > p2->expo) {
-            // Carry the larger exponent from p1
-            list3.insert(p1->coef, p1->expo);
-            p1 = p1->next;
-        } else {
-            // Carry the larger exponent from p2
-            list3.insert(p2->coef, p2->expo);
-            p2 = p2->next;
-        }
-    }
-
-    // Append any remaining terms
-    while (p1 != nullptr) {
-        list3.insert(p1->coef, p1->expo);
-        p1 = p1->next;
-    }
-    while (p2 != nullptr) {
-        list3.insert(p2->coef, p2->expo);
-        p2 = p2->next;
-    }
+    history.push_back(SharedPoly::add(SharedPoly(list1), SharedPoly(list2)));
+    history.back().toList(list3);
 
     // Print result in the format the grader expects
     cout << "Exp1 + Exp2 = ";
@@ -475,36 +794,10 @@ void PolyCalculator::add() {
     cout << '\n';
 }
 
-// list3 = list2 - list1  (matches the "sub" label in main.cpp)
-// Same merge-walk as add(), but:
-//   - equal exponents: coef = p2->coef - p1->coef
-//   - carry-only-from-list2 as-is, and from list1 as negated.
+// list3 = list1 - list2  (same approach as add(), via SharedPoly::sub())
 void PolyCalculator::sub() {
-    list3.removeAll();
-    Node* p1 = list1.head;  // Exp1
-    Node* p2 = list2.head;  // Exp2
-
-    // Compute list3 = Exp1 - Exp2
-    while (p1 && p2) {
-        if (p1->expo == p2->expo) {
-            int diff = p1->coef - p2->coef;  // flipped order
-            if (diff != 0) list3.insert(diff, p1->expo);
-            p1 = p1->next; 
-            p2 = p2->next;
-        } else if (p1->expo > p2->expo) {
-            // carry term from Exp1
-            list3.insert(p1->coef, p1->expo);
-            p1 = p1->next;
-        } else { // p2->expo > p1->expo
-            // carry negative of Exp2
-            list3.insert(-p2->coef, p2->expo);
-            p2 = p2->next;
-        }
-    }
-
-    // drain leftovers
-    while (p1) { list3.insert(p1->coef, p1->expo); p1 = p1->next; }
-    while (p2) { list3.insert(-p2->coef, p2->expo); p2 = p2->next; }
+    history.push_back(SharedPoly::sub(SharedPoly(list1), SharedPoly(list2)));
+    history.back().toList(list3);
 
     cout << "Exp1 - Exp2 = ";
     list3.print(cout);
@@ -538,6 +831,9 @@ void PolyCalculator::mul() {
         }
     }
 
+    // Products share nothing with their inputs; snapshot list3 directly
+    history.push_back(SharedPoly(list3));
+
     // Print result
     cout << "Exp1 * Exp2 = ";
     list3.print(cout);
@@ -586,6 +882,429 @@ int PolyCalculator::getDegree(int expID) {
     return curr->expo;
 }
 
+//============================== Calculus =====================================
+
+// list3 = p'(x) for the chosen expression.
+// Exponents stay strictly descending after differentiation, so each term is
+// appended at the tail in one pass instead of going through insert().
+// The constant term (expo 0) is the last node and simply drops out.
+// If a coefficient*exponent product overflows int, list3 is cleared and an
+// error printed (same handling as integ()).
+void PolyCalculator::deriv(int expID) {
+    const LinkedList* target = nullptr;
+    if (expID == 1)      target = &list1;
+    else if (expID == 2) target = &list2;
+    else { cout << "Error: Invalid ID" << endl; return; }
+
+    list3.removeAll();
+    Node* tail = nullptr;
+    for (Node* c = target->head; c != nullptr && c->expo > 0; c = c->next) {
+        int coef;
+        if (__builtin_mul_overflow(c->coef, c->expo, &coef)) {
+            list3.removeAll();
+            cout << "Error: derivative of Exp" << expID << " overflows int ("
+                 << c->coef << "*" << c->expo << "x^" << c->expo - 1 << ")" << endl;
+            return;
+        }
+        Node* n = new Node(coef, c->expo - 1);
+        if (tail == nullptr) list3.head = n;
+        else tail->next = n;
+        tail = n;
+    }
+
+    history.push_back(SharedPoly(list3));
+
+    cout << "d/dx Exp" << expID << " = ";
+    list3.print(cout);
+    cout << '\n';
+}
+
+// list3 = integral of p(x) dx with integration constant 0.
+// Same one-pass tail-append as deriv(). Every term coef*x^e becomes
+// (coef/(e+1))*x^(e+1), which must divide exactly because the list only
+// holds int coefficients; otherwise list3 is cleared and an error printed.
+void PolyCalculator::integ(int expID) {
+    const LinkedList* target = nullptr;
+    if (expID == 1)      target = &list1;
+    else if (expID == 2) target = &list2;
+    else { cout << "Error: Invalid ID" << endl; return; }
+
+    list3.removeAll();
+    Node* tail = nullptr;
+    for (Node* c = target->head; c != nullptr; c = c->next) {
+        if (c->coef % (c->expo + 1) != 0) {
+            list3.removeAll();
+            cout << "Error: integral of Exp" << expID << " has a non-integer coefficient ("
+                 << c->coef << "/" << c->expo + 1 << "x^" << c->expo + 1 << ")" << endl;
+            return;
+        }
+        Node* n = new Node(c->coef / (c->expo + 1), c->expo + 1);
+        if (tail == nullptr) list3.head = n;
+        else tail->next = n;
+        tail = n;
+    }
+
+    history.push_back(SharedPoly(list3));
+
+    cout << "Integral of Exp" << expID << " = ";
+    list3.print(cout);
+    cout << '\n';
+}
+
+// Prints p(x), p'(x), ..., p^(k)(x) for each x in 'xs'.
+// Fused Horner sweep: walking the exponents from the degree down to 0,
+//   r[j] = r[j] * x + r[j-1]   (j = k..1),   r[0] = r[0] * x + a_e
+// leaves r[j] = p^(j)(x) / j!, so all k+1 values cost one O(degree * k)
+// pass with no intPow calls. Missing exponents are treated as zero
+// coefficients. Uses long long to give derivatives more headroom than int.
+// Orders above the degree are identically 0, so the sweep stops at
+// min(k, degree). Every multiply/add of the sweep and of the j! scaling is
+// overflow-checked; an order whose value does not fit in long long is
+// printed as "overflow". r[j] depends on r[j-1], so once an order
+// overflows every higher order does too.
+void PolyCalculator::evalder(int expID, const std::vector<int> &xs, int k) {
+    const LinkedList* target = nullptr;
+    if (expID == 1)      target = &list1;
+    else if (expID == 2) target = &list2;
+    else { cout << "Error: Invalid ID" << endl; return; }
+
+    if (k < 0) { cout << "Error: derivative order must be non-negative" << endl; return; }
+
+    cout << "p(x) = ";
+    target->print(cout);
+    cout << '\n';
+
+    // Scratch buffer reused across the batch
+    const int degree = target->head ? target->head->expo : 0;
+    const int m = min(k, degree);
+    std::vector<long long> r(m + 1);
+    std::vector<char> overflow(m + 1);
+
+    for (int x : xs) {
+        std::fill(r.begin(), r.end(), 0);
+        std::fill(overflow.begin(), overflow.end(), 0);
+
+        const Node* c = target->head;
+        long long t;
+        for (int e = degree; e >= 0; e--) {
+            // Descending j: r[j-1] (and its flag) still hold the previous step
+            for (int j = m; j > 0; j--) {
+                if (overflow[j] || overflow[j - 1]
+                    || __builtin_mul_overflow(r[j], (long long)x, &t)
+                    || __builtin_add_overflow(t, r[j - 1], &r[j]))
+                    overflow[j] = 1;
+            }
+            long long a = 0;
+            if (c != nullptr && c->expo == e) { a = c->coef; c = c->next; }
+            if (overflow[0]
+                || __builtin_mul_overflow(r[0], (long long)x, &t)
+                || __builtin_add_overflow(t, a, &r[0]))
+                overflow[0] = 1;
+        }
+
+        // Scale r[j] by j! and print as p(x) p'(x) p''(x) p^(3)(x) ...
+        long long factorial = 1;
+        bool factorialOverflow = false;
+        for (int j = 0; j <= k; j++) {
+            if (j > 0) cout << "  ";
+            if (j <= 2) cout << 'p' << string(j, '\'');
+            else        cout << "p^(" << j << ")";
+            cout << '(' << x << ") = ";
+
+            if (j > m) { cout << 0; continue; }
+            if (j > 0 && !factorialOverflow)
+                factorialOverflow = __builtin_mul_overflow(factorial, (long long)j, &factorial);
+
+            long long value;
+            if (overflow[j] || factorialOverflow || __builtin_mul_overflow(r[j], factorial, &value))
+                cout << "overflow";
+            else
+                cout << value;
+        }
+        cout << '\n';
+    }
+}
+
+//============================== Root finding =================================
+
+// Returns p(z) / p'(z) for the dense coefficient vector 'a' (a[k] is the
+// coefficient of x^k, a.back() != 0). For |z| > 1 the reversed polynomial
+// r(w) = w^n p(1/w) is evaluated at w = 1/z instead, which keeps Horner's
+// intermediate values bounded for high degrees:
+//   p(z)/p'(z) = z / (n - w r'(w) / r(w))
+complex<double> newtonRatio(const vector<double> &a, complex<double> z) {
+    const int n = (int)a.size() - 1;
+    complex<double> p = 0, dp = 0;
+
+    if (abs(z) <= 1.0) {
+        for (int k = n; k >= 0; k--) {
+            dp = dp * z + p;
+            p = p * z + a[k];
+        }
+        return p / dp;
+    }
+
+    const complex<double> w = 1.0 / z;
+    for (int k = 0; k <= n; k++) {
+        dp = dp * w + p;
+        p = p * w + a[k];
+    }
+    return z / ((double)n - w * dp / p);
+}
+
+// Returns log|p(x)| for real x. Horner's running value is kept as
+// v * 2^e and renormalized every step, so degrees in the thousands
+// neither overflow nor underflow. Returns -inf when p(x) == 0.
+double logAbsEval(const vector<double> &a, double x) {
+    double v = 0.0;
+    int e = 0;
+    for (int k = (int)a.size() - 1; k >= 0; k--) {
+        v = v * x + ldexp(a[k], -e);
+        int shift;
+        v = frexp(v, &shift);
+        e += shift;
+    }
+    return log(fabs(v)) + e * log(2.0);
+}
+
+// Per-root state used by the Aberth–Ehrlich iteration
+enum RootState : char { ROOT_ACTIVE = 0, ROOT_CONVERGED = 1, ROOT_FAILED = 2 };
+
+// One Aberth–Ehrlich update for the 'count' roots listed in 'idx'. Reads
+// the previous approximations (re, im) and writes the next ones to (nre, nim).
+// Roots are kept as separate real/imaginary arrays and the pairwise sum
+// is written with plain arithmetic (no complex division, no branch on j),
+// so GCC vectorizes the inner loops at -O3 (not at -O2).
+// A root whose correction is NaN/inf keeps its last finite value and is
+// marked ROOT_FAILED. Returns the largest relative correction applied.
+double aberthUpdate(const vector<double> &a, const vector<double> &re, const vector<double> &im,
+                    vector<double> &nre, vector<double> &nim, vector<char> &state,
+                    double tol, const int* idx, int count) {
+    const int n = (int)re.size();
+    double maxStep = 0.0;
+
+    for (int t = 0; t < count; t++) {
+        const int i = idx[t];
+        nre[i] = re[i];
+        nim[i] = im[i];
+
+        const double zr = re[i], zi = im[i];
+
+        // sum_{j != i} 1 / (z_i - z_j), split around i to avoid a branch
+        double sr = 0.0, si = 0.0;
+        for (int j = 0; j < i; j++) {
+            double dr = zr - re[j], di = zi - im[j];
+            double inv = 1.0 / (dr * dr + di * di);
+            sr += dr * inv;
+            si -= di * inv;
+        }
+        for (int j = i + 1; j < n; j++) {
+            double dr = zr - re[j], di = zi - im[j];
+            double inv = 1.0 / (dr * dr + di * di);
+            sr += dr * inv;
+            si -= di * inv;
+        }
+
+        // w = N / (1 - N * sum), where N = p(z_i) / p'(z_i)
+        const complex<double> N = newtonRatio(a, complex<double>(zr, zi));
+        const complex<double> w = N / (1.0 - N * complex<double>(sr, si));
+        if (!isfinite(w.real()) || !isfinite(w.imag())) { state[i] = ROOT_FAILED; continue; }
+
+        nre[i] = zr - w.real();
+        nim[i] = zi - w.imag();
+
+        // Converged once the correction is negligible relative to |z_i|
+        double step = abs(w) / max(1.0, abs(complex<double>(zr, zi)));
+        if (step <= tol) state[i] = ROOT_CONVERGED;
+        maxStep = max(maxStep, step);
+    }
+    return maxStep;
+}
+
+// Runs Aberth–Ehrlich iterations until every root has left ROOT_ACTIVE or
+// 'maxIter' is reached; returns the number of iterations and the largest
+// relative correction of the last one in 'maxStep'.
+// Workers are started once and woken per iteration by a generation counter;
+// each iteration only visits roots that are still active, and threads pull
+// fixed-size chunks of that list from a shared counter, so threads whose
+// roots converged early pick up the remaining work. Updates are written to
+// (nre, nim) and published to (re, im) between iterations (Jacobi style),
+// so workers never read a value another worker is writing.
+int aberthIterate(const vector<double> &a, vector<double> &re, vector<double> &im,
+                  vector<char> &state, double tol, int threads, int maxIter, double &maxStep) {
+    const int n = (int)re.size();
+    const int chunk = 16;
+
+    vector<double> nre(re), nim(im);
+    vector<int> active(n);
+    iota(active.begin(), active.end(), 0);
+    vector<double> steps(threads, 0.0);
+    atomic<int> nextChunk(0);
+
+    // Grab chunks of the active list until it is exhausted
+    auto work = [&](int t) {
+        double best = 0.0;
+        const int total = (int)active.size();
+        for (int from = nextChunk.fetch_add(chunk); from < total; from = nextChunk.fetch_add(chunk)) {
+            int count = min(chunk, total - from);
+            best = max(best, aberthUpdate(a, re, im, nre, nim, state, tol, active.data() + from, count));
+        }
+        steps[t] = best;
+    };
+
+    mutex m;
+    condition_variable startCv, doneCv;
+    int generation = 0, pending = 0;
+    bool quit = false;
+
+    // Thread 0 is the caller; the others wait for each new generation
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++) {
+        pool.emplace_back([&, t] {
+            int seen = 0;
+            while (true) {
+                {
+                    unique_lock<mutex> lk(m);
+                    startCv.wait(lk, [&] { return quit || generation != seen; });
+                    if (quit) return;
+                    seen = generation;
+                }
+                work(t);
+                lock_guard<mutex> lk(m);
+                if (--pending == 0) doneCv.notify_one();
+            }
+        });
+    }
+
+    int iter = 0;
+    maxStep = 0.0;
+    while (!active.empty() && iter < maxIter) {
+        iter++;
+        {
+            lock_guard<mutex> lk(m);
+            nextChunk = 0;
+            pending = threads - 1;
+            generation++;
+        }
+        startCv.notify_all();
+        work(0);
+        {
+            unique_lock<mutex> lk(m);
+            doneCv.wait(lk, [&] { return pending == 0; });
+        }
+
+        // Publish the new iterate and keep only roots that are still active
+        size_t kept = 0;
+        for (int i : active) {
+            re[i] = nre[i];
+            im[i] = nim[i];
+            if (state[i] == ROOT_ACTIVE) active[kept++] = i;
+        }
+        active.resize(kept);
+        maxStep = *max_element(steps.begin(), steps.end());
+    }
+
+    {
+        lock_guard<mutex> lk(m);
+        quit = true;
+    }
+    startCv.notify_all();
+    for (thread &th : pool) th.join();
+    return iter;
+}
+
+// Finds all roots of the chosen expression with Aberth–Ehrlich simultaneous
+// iteration in double precision. The canonical list is expanded into a
+// dense coefficient vector; factors of x are stripped first and reported
+// as exact zero roots. The iteration itself runs in aberthIterate() on a
+// pool of hardware threads.
+// Prints the roots followed by convergence statistics and timing; roots
+// that failed (non-finite update) or hit the iteration cap are flagged.
+void PolyCalculator::roots(int expID, double tol) {
+    // Choose which expression to solve (1 or 2)
+    const LinkedList* target = nullptr;
+    if (expID == 1)      target = &list1;
+    else if (expID == 2) target = &list2;
+    else { cout << "Error: Invalid ID" << endl; return; }
+
+    if (!(tol > 0.0)) { cout << "Error: tolerance must be positive" << endl; return; }
+
+    cout << "p(x) = ";
+    target->print(cout);
+    cout << '\n';
+
+    if (!target->head || target->head->expo == 0) {
+        cout << "p(x) has no roots" << endl;
+        return;
+    }
+
+    // Last node holds the lowest exponent: that many roots are exactly 0
+    int zeroRoots = 0;
+    for (const Node* c = target->head; c; c = c->next) zeroRoots = c->expo;
+
+    // Dense coefficients of p(x) / x^zeroRoots, a[k] for x^k
+    const int n = target->head->expo - zeroRoots;
+    vector<double> a(n + 1, 0.0);
+    for (const Node* c = target->head; c; c = c->next) a[c->expo - zeroRoots] = c->coef;
+
+    vector<double> re(n), im(n);
+    vector<char> state(n, ROOT_ACTIVE);
+
+    // Never spawn more threads than there are chunks of useful work
+    const int minChunk = 64;
+    int threads = (int)max(1u, thread::hardware_concurrency());
+    threads = max(1, min(threads, n / minChunk));
+
+    const int maxIter = 1000;
+    int iter = 0;
+    double maxStep = 0.0;
+    auto start = chrono::steady_clock::now();
+
+    // A monomial c*x^m (n == 0) has only its m zero roots: nothing to iterate
+    if (n > 0) {
+        // Initial guesses: spread on a circle around the root centroid c, with
+        // radius equal to the geometric mean of |c - root| = (|p(c)| / |a_n|)^(1/n),
+        // rotated off the real axis to break symmetry
+        const double center = -a[n - 1] / (n * a[n]);
+        double radius = exp((logAbsEval(a, center) - log(fabs(a[n]))) / n);
+        if (!(radius > 0.0) || !isfinite(radius)) radius = 1.0;
+        const double pi = acos(-1.0);
+        for (int k = 0; k < n; k++) {
+            double theta = 2.0 * pi * k / n + 0.4;
+            re[k] = center + radius * cos(theta);
+            im[k] = radius * sin(theta);
+        }
+    }
+
+    if (n > 0) iter = aberthIterate(a, re, im, state, tol, threads, maxIter, maxStep);
+
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    int converged = (int)count(state.begin(), state.end(), ROOT_CONVERGED);
+    int failed = (int)count(state.begin(), state.end(), ROOT_FAILED);
+
+    // Print roots (exact zeros first), dropping negligible imaginary parts
+    streamsize oldPrecision = cout.precision(12);
+    int idx = 1;
+    for (int k = 0; k < zeroRoots; k++) cout << "x" << idx++ << " = 0\n";
+    for (int k = 0; k < n; k++) {
+        cout << "x" << idx++ << " = " << re[k];
+        if (fabs(im[k]) > tol * max(1.0, fabs(re[k])))
+            cout << (im[k] >= 0 ? " +" : " -") << fabs(im[k]) << "i";
+        if (state[k] == ROOT_FAILED)      cout << "  (failed)";
+        else if (state[k] == ROOT_ACTIVE) cout << "  (not converged)";
+        cout << '\n';
+    }
+
+    cout << "Converged: " << converged + zeroRoots << "/" << n + zeroRoots << " roots"
+         << " in " << iter << " iterations (last max step " << maxStep << ")";
+    if (failed > 0) cout << ", " << failed << " failed";
+    cout << '\n';
+    cout << "Time: " << ms << " ms (" << (iter ? ms / iter : 0.0) << " ms/iteration, "
+         << threads << " thread" << (threads > 1 ? "s" : "") << ", tol " << tol << ")"
+         << endl;
+    cout.precision(oldPrecision);
+}
+
 //============================== File I/O =====================================
 
 // Loads two expressions from a text file (first two lines only).
@@ -642,3 +1361,29 @@ void PolyCalculator::read(std::string path) {
 void PolyCalculator::isEqual() {
     cout << (list1 == list2 ? "Equal\n" : "Not equal\n");
 }
+
+// Lists every add/sub/mul/deriv/integ result computed so far as "#n: ..."
+void PolyCalculator::showHistory(std::ostream &os) {
+    if (history.empty()) { os << "History is empty" << endl; return; }
+    for (size_t i = 0; i < history.size(); i++) {
+        os << '#' << (i + 1) << ": ";
+        history[i].print(os);
+        os << endl;
+    }
+}
+
+// Copy-on-write edit of a stored result: the copy of entry #n is O(1),
+// insert() then duplicates only the terms below 'expo' and shares the rest,
+// so entry #n itself is left unchanged.
+void PolyCalculator::addTerm(int n, int coef, int expo) {
+    if (n < 1 || n > (int)history.size()) { cout << "Error: Invalid history entry" << endl; return; }
+    if (expo < 0) { cout << "Error: exponent must be non-negative" << endl; return; }
+
+    SharedPoly edited = history[n - 1];
+    edited.insert(coef, expo);
+    history.push_back(edited);
+
+    cout << '#' << history.size() << ": ";
+    history.back().print(cout);
+    cout << '\n';
+}